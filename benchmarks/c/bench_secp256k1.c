@@ -0,0 +1,229 @@
+#define _POSIX_C_SOURCE 200809L
+// bench_secp256k1.c - libsecp256k1 native baseline for the secp256k1 benchmarks.
+// SPDX-License-Identifier: MIT
+//
+// Runs the corpus, sampling and checksums of benchmarks/mojo_benchmark.mojo so
+// run_full_benchmarks.py can line the two up operation by operation.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <secp256k1.h>
+#include <secp256k1_recovery.h>
+
+#include "keccak256.h"
+
+#define NUM_KEYS 64
+#define SAMPLES 50
+
+static uint8_t keys[NUM_KEYS][32];
+static uint8_t digests[NUM_KEYS][32];
+static secp256k1_ecdsa_recoverable_signature rsigs[NUM_KEYS];
+static secp256k1_ecdsa_signature sigs[NUM_KEYS];
+static secp256k1_pubkey pubs[NUM_KEYS];
+static secp256k1_context *ctx;
+
+static void corpus_key(size_t index, uint8_t out[32]) {
+    // nonzero and below n: the top bit is cleared and the last byte is odd
+    for (size_t offset = 0; offset < 32; ++offset) {
+        out[offset] = (uint8_t)((index * 131 + offset * 29 + 7) % 256);
+    }
+    out[0] &= 0x7F;
+    out[31] |= 1;
+}
+
+static void corpus_digest(size_t index, uint8_t out[32]) {
+    for (size_t offset = 0; offset < 32; ++offset) {
+        out[offset] = (uint8_t)((index + offset) % 256);
+    }
+}
+
+static void die(const char *what) {
+    fprintf(stderr, "libsecp256k1 call failed: %s\n", what);
+    exit(EXIT_FAILURE);
+}
+
+static int xy_checksum(const secp256k1_pubkey *pub) {
+    uint8_t raw[65];
+    size_t len = sizeof(raw);
+    secp256k1_ec_pubkey_serialize(ctx, raw, &len, pub, SECP256K1_EC_UNCOMPRESSED);
+    return raw[1] ^ raw[64];
+}
+
+static int rsv_checksum(const secp256k1_ecdsa_recoverable_signature *sig) {
+    uint8_t rs[64];
+    int recid = 0;
+    secp256k1_ecdsa_recoverable_signature_serialize_compact(ctx, rs, &recid, sig);
+    return rs[0] ^ rs[32] ^ (27 + recid);
+}
+
+static int op_point_mul_fixed(size_t i) {
+    secp256k1_pubkey pub;
+    if (!secp256k1_ec_pubkey_create(ctx, &pub, keys[i])) die("ec_pubkey_create");
+    return xy_checksum(&pub);
+}
+
+static int op_point_mul_variable(size_t i) {
+    secp256k1_pubkey pub = pubs[i];
+    if (!secp256k1_ec_pubkey_tweak_mul(ctx, &pub, digests[i])) die("ec_pubkey_tweak_mul");
+    return xy_checksum(&pub);
+}
+
+static int op_sign(size_t i) {
+    secp256k1_ecdsa_recoverable_signature sig;
+    if (!secp256k1_ecdsa_sign_recoverable(ctx, &sig, digests[i], keys[i], NULL, NULL)) die("ecdsa_sign_recoverable");
+    return rsv_checksum(&sig);
+}
+
+static int op_sign_signing_key(size_t i) {
+    // libsecp256k1 keeps no per-key state, so this is key 0 through the same call
+    secp256k1_ecdsa_recoverable_signature sig;
+    if (!secp256k1_ecdsa_sign_recoverable(ctx, &sig, digests[i], keys[0], NULL, NULL)) die("ecdsa_sign_recoverable");
+    return rsv_checksum(&sig);
+}
+
+static int op_verify(size_t i) {
+    return secp256k1_ecdsa_verify(ctx, &sigs[i], digests[i], &pubs[i]) ? (int)i + 1 : 0;
+}
+
+static int op_recover(size_t i) {
+    secp256k1_pubkey pub;
+    if (!secp256k1_ecdsa_recover(ctx, &pub, &rsigs[i], digests[i])) die("ecdsa_recover");
+    return xy_checksum(&pub);
+}
+
+static int op_recover_address(size_t i) {
+    secp256k1_pubkey pub;
+    uint8_t raw[65];
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+    size_t len = sizeof(raw);
+    if (!secp256k1_ecdsa_recover(ctx, &pub, &rsigs[i], digests[i])) die("ecdsa_recover");
+    secp256k1_ec_pubkey_serialize(ctx, raw, &len, &pub, SECP256K1_EC_UNCOMPRESSED);
+    keccak256(raw + 1, 64, digest);
+    return digest[12] ^ digest[31];
+}
+
+static double seconds_since(const struct timespec *start, const struct timespec *end) {
+    double sec = (double)(end->tv_sec - start->tv_sec);
+    double nsec = (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+    return sec + nsec;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+struct bench_result {
+    const char *operation;
+    long iterations;
+    double seconds;
+    double pass_mean_p50_ns;
+    double pass_mean_p99_ns;
+    int checksum;
+};
+
+static struct bench_result run_bench(const char *operation, int (*op)(size_t)) {
+    // one untimed pass for the checksum, then SAMPLES timed passes, each sampled as its mean ns per op
+    struct bench_result res = {operation, (long)SAMPLES * NUM_KEYS, 0.0, 0.0, 0.0, 0};
+    double lat[SAMPLES];
+    volatile int sink = 0;
+    struct timespec start;
+    struct timespec end;
+
+    for (size_t idx = 0; idx < NUM_KEYS; ++idx) {
+        res.checksum ^= op(idx);
+    }
+    for (int sample = 0; sample < SAMPLES; ++sample) {
+        if (clock_gettime(CLOCK_MONOTONIC, &start) != 0) {
+            perror("clock_gettime");
+            exit(EXIT_FAILURE);
+        }
+        for (size_t idx = 0; idx < NUM_KEYS; ++idx) {
+            sink += op(idx);
+        }
+        if (clock_gettime(CLOCK_MONOTONIC, &end) != 0) {
+            perror("clock_gettime");
+            exit(EXIT_FAILURE);
+        }
+        double s = seconds_since(&start, &end);
+        res.seconds += s;
+        lat[sample] = s * 1e9 / NUM_KEYS;
+    }
+    (void)sink;
+    qsort(lat, SAMPLES, sizeof(double), cmp_double);
+    res.pass_mean_p50_ns = lat[SAMPLES / 2];
+    res.pass_mean_p99_ns = lat[(SAMPLES * 99 + 99) / 100 - 1];
+    return res;
+}
+
+static void setup(void) {
+    ctx = secp256k1_context_create(SECP256K1_CONTEXT_NONE);
+    if (ctx == NULL) die("context_create");
+    for (size_t i = 0; i < NUM_KEYS; ++i) {
+        corpus_key(i, keys[i]);
+        corpus_digest(i, digests[i]);
+        if (!secp256k1_ec_pubkey_create(ctx, &pubs[i], keys[i])) die("ec_pubkey_create");
+        if (!secp256k1_ecdsa_sign_recoverable(ctx, &rsigs[i], digests[i], keys[i], NULL, NULL)) {
+            die("ecdsa_sign_recoverable");
+        }
+        secp256k1_ecdsa_recoverable_signature_convert(ctx, &sigs[i], &rsigs[i]);
+    }
+}
+
+static double ops_per_second(const struct bench_result *r) {
+    return r->seconds > 0.0 ? (double)r->iterations / r->seconds : 0.0;
+}
+
+int main(int argc, char **argv) {
+    const char *label = "c (libsecp256k1)";
+    int emit_json = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0) {
+            emit_json = 1;
+        } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+            label = argv[i + 1];
+            ++i;
+        }
+    }
+
+    setup();
+    struct bench_result results[] = {
+        run_bench("point_mul_fixed", op_point_mul_fixed),
+        run_bench("point_mul_variable", op_point_mul_variable),
+        run_bench("sign", op_sign),
+        run_bench("sign_signing_key", op_sign_signing_key),
+        run_bench("verify", op_verify),
+        run_bench("recover", op_recover),
+        run_bench("recover_address", op_recover_address),
+    };
+    const size_t count = sizeof(results) / sizeof(results[0]);
+    secp256k1_context_destroy(ctx);
+
+    if (emit_json) {
+        printf("[");
+        for (size_t i = 0; i < count; ++i) {
+            const struct bench_result *r = &results[i];
+            printf("%s{\"implementation\": \"%s\", \"operation\": \"%s\", \"iterations\": %ld, "
+                   "\"seconds\": %.12f, \"ops_per_second\": %.2f, \"pass_mean_p50_ns\": %.1f, "
+                   "\"pass_mean_p99_ns\": %.1f, \"checksum\": %d}",
+                   i > 0 ? ", " : "", label, r->operation, r->iterations, r->seconds, ops_per_second(r),
+                   r->pass_mean_p50_ns, r->pass_mean_p99_ns, r->checksum);
+        }
+        printf("]\n");
+    } else {
+        printf("implementation | operation | ops/s | pass-mean p50 ns | pass-mean p99 ns | checksum\n");
+        printf("-------------- | --------- | ----- | ---------------- | ---------------- | --------\n");
+        for (size_t i = 0; i < count; ++i) {
+            const struct bench_result *r = &results[i];
+            printf("%s | %s | %.2f | %.1f | %.1f | %d\n", label, r->operation, ops_per_second(r),
+                   r->pass_mean_p50_ns, r->pass_mean_p99_ns, r->checksum);
+        }
+    }
+    return 0;
+}
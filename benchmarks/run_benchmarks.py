@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""libsecp256k1 (coincurve) baseline for the secp256k1 benchmarks."""
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+import time
+from typing import Callable, Dict, List
+
+# Corpus and sampling shared with the Mojo benchmark. Keep these in sync with
+# the constants and corpus_* functions in ``benchmarks/mojo_benchmark.mojo``.
+NUM_KEYS = 64
+SAMPLES = 50
+
+Result = Dict[str, float | str | int]
+
+
+def corpus_key(index: int) -> bytes:
+    key = bytearray((index * 131 + offset * 29 + 7) % 256 for offset in range(32))
+    key[0] &= 0x7F
+    key[31] |= 1
+    return bytes(key)
+
+
+def corpus_digest(index: int) -> bytes:
+    return bytes((index + offset) % 256 for offset in range(32))
+
+
+def _require_module(module: str) -> None:
+    try:
+        __import__(module)
+    except ModuleNotFoundError as exc:  # pragma: no cover - import guard
+        raise SystemExit(
+            f"Missing optional dependency '{module}'. Install via `pixi install` "
+            "or `pip install` before running the benchmarks."
+        ) from exc
+
+
+def _der(r: bytes, s: bytes) -> bytes:
+    def _int(v: bytes) -> bytes:
+        v = v.lstrip(b"\x00") or b"\x00"
+        if v[0] & 0x80:
+            v = b"\x00" + v
+        return b"\x02" + bytes([len(v)]) + v
+
+    body = _int(r) + _int(s)
+    return b"\x30" + bytes([len(body)]) + body
+
+
+def run_bench(operation: str, op: Callable[[int], int], label: str) -> Result:
+    """One untimed pass for the checksum, then SAMPLES timed passes, each sampled as its mean ns per op."""
+    checksum = 0
+    for idx in range(NUM_KEYS):
+        checksum ^= op(idx)
+    latencies: List[float] = []
+    total = 0
+    for _ in range(SAMPLES):
+        start = time.perf_counter_ns()
+        for idx in range(NUM_KEYS):
+            op(idx)
+        elapsed = time.perf_counter_ns() - start
+        total += elapsed
+        latencies.append(elapsed / NUM_KEYS)
+    latencies.sort()
+    p99 = (SAMPLES * 99 + 99) // 100 - 1
+    seconds = total / 1e9
+    iterations = SAMPLES * NUM_KEYS
+    return {
+        "implementation": label,
+        "operation": operation,
+        "iterations": iterations,
+        "seconds": seconds,
+        "ops_per_second": iterations / seconds if seconds > 0 else 0.0,
+        "pass_mean_p50_ns": latencies[SAMPLES // 2],
+        "pass_mean_p99_ns": latencies[p99],
+        "checksum": checksum,
+    }
+
+
+def bench_coincurve(label: str) -> List[Result]:
+    _require_module("coincurve")
+    _require_module("Crypto")
+    from coincurve import PrivateKey, PublicKey
+    from Crypto.Hash import keccak
+
+    keys = [corpus_key(i) for i in range(NUM_KEYS)]
+    digests = [corpus_digest(i) for i in range(NUM_KEYS)]
+    privs = [PrivateKey(k) for k in keys]
+    pubs = [p.public_key for p in privs]
+    sigs = [p.sign_recoverable(d, hasher=None) for p, d in zip(privs, digests)]
+    ders = [_der(s[0:32], s[32:64]) for s in sigs]
+    signer = privs[0]
+
+    def _xy(pub: PublicKey) -> int:
+        raw = pub.format(compressed=False)
+        return raw[1] ^ raw[64]
+
+    def _rsv(sig: bytes) -> int:
+        return sig[0] ^ sig[32] ^ (27 + sig[64])
+
+    def point_mul_fixed(i: int) -> int:
+        return _xy(PublicKey.from_secret(keys[i]))
+
+    def point_mul_variable(i: int) -> int:
+        return _xy(pubs[i].multiply(digests[i]))
+
+    def sign(i: int) -> int:
+        return _rsv(PrivateKey(keys[i]).sign_recoverable(digests[i], hasher=None))
+
+    def sign_signing_key(i: int) -> int:
+        return _rsv(signer.sign_recoverable(digests[i], hasher=None))
+
+    def verify(i: int) -> int:
+        return i + 1 if pubs[i].verify(ders[i], digests[i], hasher=None) else 0
+
+    def recover(i: int) -> int:
+        return _xy(PublicKey.from_signature_and_message(sigs[i], digests[i], hasher=None))
+
+    def recover_address(i: int) -> int:
+        pub = PublicKey.from_signature_and_message(sigs[i], digests[i], hasher=None)
+        addr = keccak.new(digest_bits=256, data=pub.format(compressed=False)[1:]).digest()[12:]
+        return addr[0] ^ addr[19]
+
+    ops = [
+        ("point_mul_fixed", point_mul_fixed),
+        ("point_mul_variable", point_mul_variable),
+        ("sign", sign),
+        ("sign_signing_key", sign_signing_key),
+        ("verify", verify),
+        ("recover", recover),
+        ("recover_address", recover_address),
+    ]
+    return [run_bench(name, op, label) for name, op in ops]
+
+
+def format_results(results: List[Result]) -> str:
+    headers = ("implementation", "operation", "ops/s", "pass-mean p50 ns", "pass-mean p99 ns", "checksum")
+    lines = [" | ".join(headers)]
+    lines.append(" | ".join("-" * len(h) for h in headers))
+    for result in results:
+        lines.append(
+            " | ".join(
+                [
+                    str(result["implementation"]),
+                    str(result["operation"]),
+                    f"{float(result['ops_per_second']):.2f}",
+                    f"{float(result['pass_mean_p50_ns']):.1f}",
+                    f"{float(result['pass_mean_p99_ns']):.1f}",
+                    str(result["checksum"]),
+                ]
+            )
+        )
+    return "\n".join(lines)
+
+
+def main(argv: List[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--label",
+        default="libsecp256k1 (coincurve)",
+        help="Label to display for the coincurve baseline.",
+    )
+    parser.add_argument(
+        "--json",
+        action="store_true",
+        help="Emit benchmark results as JSON instead of a table.",
+    )
+    args = parser.parse_args(argv)
+    results = bench_coincurve(args.label)
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+    else:
+        print(format_results(results))
+    return 0
+
+
+if __name__ == "__main__":  # pragma: no cover - CLI entry point
+    sys.exit(main())
@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""Aggregate libsecp256k1 and Mojo secp256k1 benchmark results into one report."""
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+from typing import Dict, List
+
+
+Result = Dict[str, float | str | int]
+
+MOJO_INCLUDES = [".", "decimojo/src", "keccak"]
+
+
+def _run_checked(cmd: List[str], *, cwd: Path | None = None) -> str:
+    proc = subprocess.run(
+        cmd,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.PIPE,
+        text=True,
+        cwd=cwd,
+    )
+    if proc.returncode != 0:
+        message = (
+            f"Command {' '.join(cmd)} failed with exit code {proc.returncode}\n"
+            f"stdout:\n{proc.stdout}\n"
+            f"stderr:\n{proc.stderr}"
+        )
+        raise SystemExit(message)
+    return proc.stdout.strip()
+
+
+def _format_table(results: List[Result]) -> str:
+    headers = ("implementation", "operation", "ops/s", "pass-mean p50 ns", "pass-mean p99 ns", "checksum")
+    lines = [" | ".join(headers)]
+    lines.append(" | ".join("-" * len(h) for h in headers))
+    for result in sorted(results, key=lambda r: str(r["operation"])):
+        lines.append(
+            " | ".join(
+                [
+                    str(result["implementation"]),
+                    str(result["operation"]),
+                    f"{float(result['ops_per_second']):.2f}",
+                    f"{float(result['pass_mean_p50_ns']):.1f}",
+                    f"{float(result['pass_mean_p99_ns']):.1f}",
+                    str(result["checksum"]),
+                ]
+            )
+        )
+    return "\n".join(lines)
+
+
+def _load_json(output: str) -> List[Result]:
+    try:
+        data = json.loads(output)
+    except json.JSONDecodeError as exc:
+        raise SystemExit(f"Failed to parse JSON output: {output}") from exc
+    if isinstance(data, dict):
+        return [data]
+    return list(data)
+
+
+def _ensure_tool(executable: str, message: str) -> str:
+    tool = shutil.which(executable)
+    if tool is None:
+        raise SystemExit(message)
+    return tool
+
+
+def _ensure_mojo() -> str:
+    return _ensure_tool(
+        "mojo",
+        "Unable to locate the `mojo` CLI. Activate your Pixi environment or install Mojo.",
+    )
+
+
+def _includes(root: Path) -> List[str]:
+    flags: List[str] = []
+    for inc in MOJO_INCLUDES:
+        flags.extend(["-I", str(root / inc)])
+    return flags
+
+
+def _collect_python_results(root: Path, args: argparse.Namespace) -> List[Result]:
+    cmd = [
+        sys.executable,
+        str(root / "benchmarks" / "run_benchmarks.py"),
+        "--label",
+        args.coincurve_label,
+        "--json",
+    ]
+    return _load_json(_run_checked(cmd, cwd=root))
+
+
+def _collect_mojo_jit(root: Path, mojo: str, args: argparse.Namespace) -> List[Result]:
+    cmd = [
+        mojo,
+        *_includes(root),
+        str(root / "benchmarks" / "mojo_benchmark.mojo"),
+        "--label",
+        args.mojo_jit_label,
+        "--json",
+    ]
+    return _load_json(_run_checked(cmd, cwd=root))
+
+
+def _collect_mojo_compiled(root: Path, mojo: str, args: argparse.Namespace) -> List[Result]:
+    build_dir = root / args.build_dir
+    build_dir.mkdir(parents=True, exist_ok=True)
+    binary = build_dir / args.binary_name
+    build_cmd = [
+        mojo,
+        "build",
+        *_includes(root),
+        str(root / "benchmarks" / "mojo_benchmark.mojo"),
+        "-o",
+        str(binary),
+    ]
+    _run_checked(build_cmd, cwd=root)
+    run_cmd = [
+        str(binary),
+        "--label",
+        args.mojo_compiled_label,
+        "--json",
+    ]
+    return _load_json(_run_checked(run_cmd, cwd=root))
+
+
+def _collect_c_baseline(root: Path, args: argparse.Namespace) -> List[Result]:
+    compiler = _ensure_tool(
+        "cc",
+        "Unable to locate a C compiler (`cc`). Install one (e.g. clang or gcc) before running the C baseline.",
+    )
+    prefix = Path(args.secp256k1_prefix) if args.secp256k1_prefix else None
+    build_dir = root / args.build_dir
+    build_dir.mkdir(parents=True, exist_ok=True)
+    binary = build_dir / args.c_binary_name
+    keccak_c = root / "keccak" / "benchmarks" / "c"
+    sources = [
+        keccak_c / "keccak256.c",
+        root / "benchmarks" / "c" / "bench_secp256k1.c",
+    ]
+    build_cmd = [
+        compiler,
+        "-O3",
+        "-std=c11",
+        "-Wall",
+        "-Wextra",
+        "-Werror",
+        "-I",
+        str(keccak_c),
+    ]
+    if prefix is not None:
+        build_cmd.extend(["-I", str(prefix / "include")])
+    build_cmd.extend(str(src) for src in sources)
+    if prefix is not None:
+        build_cmd.extend(["-L", str(prefix / "lib"), f"-Wl,-rpath,{prefix / 'lib'}"])
+    build_cmd.extend(["-lsecp256k1", "-o", str(binary)])
+    _run_checked(build_cmd, cwd=root)
+    run_cmd = [
+        str(binary),
+        "--label",
+        args.c_label,
+        "--json",
+    ]
+    return _load_json(_run_checked(run_cmd, cwd=root))
+
+
+def _format_ratios(results: List[Result], native_label: str) -> str:
+    # ops/s of every other implementation over the native C run, per operation
+    native = {
+        str(r["operation"]): float(r["ops_per_second"])
+        for r in results
+        if r["implementation"] == native_label
+    }
+    headers = ("implementation", "operation", "x native")
+    lines = [" | ".join(headers)]
+    lines.append(" | ".join("-" * len(h) for h in headers))
+    for result in sorted(results, key=lambda r: str(r["operation"])):
+        op = str(result["operation"])
+        if result["implementation"] == native_label or native.get(op, 0.0) <= 0.0:
+            continue
+        ratio = float(result["ops_per_second"]) / native[op]
+        lines.append(" | ".join([str(result["implementation"]), op, f"{ratio:.3f}"]))
+    return "\n".join(lines)
+
+
+def _check_checksums(results: List[Result]) -> List[str]:
+    # every implementation runs the same corpus, so equal operations must agree
+    seen: Dict[str, Result] = {}
+    problems: List[str] = []
+    for result in results:
+        op = str(result["operation"])
+        if op not in seen:
+            seen[op] = result
+        elif result["checksum"] != seen[op]["checksum"]:
+            problems.append(
+                f"checksum mismatch for {op}: {seen[op]['implementation']}={seen[op]['checksum']} "
+                f"vs {result['implementation']}={result['checksum']}"
+            )
+    return problems
+
+
+def main(argv: List[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--skip-coincurve",
+        action="store_true",
+        help="Skip the libsecp256k1 (coincurve) baseline.",
+    )
+    parser.add_argument(
+        "--skip-c",
+        action="store_true",
+        help="Skip the native C (libsecp256k1) baseline.",
+    )
+    parser.add_argument(
+        "--secp256k1-prefix",
+        default=os.environ.get("CONDA_PREFIX", ""),
+        help="Install prefix holding include/secp256k1.h and lib/libsecp256k1 (default: $CONDA_PREFIX).",
+    )
+    parser.add_argument(
+        "--skip-mojo-jit",
+        action="store_true",
+        help="Skip the Mojo JIT benchmark.",
+    )
+    parser.add_argument(
+        "--skip-mojo-compiled",
+        action="store_true",
+        help="Skip the Mojo compiled benchmark.",
+    )
+    parser.add_argument(
+        "--json",
+        action="store_true",
+        help="Emit combined results as JSON.",
+    )
+    parser.add_argument(
+        "--build-dir",
+        default=".bench-build",
+        help="Directory for compiled Mojo artifacts (default: .bench-build).",
+    )
+    parser.add_argument(
+        "--binary-name",
+        default="mojo_secp256k1_bench",
+        help="Filename for the compiled Mojo benchmark binary.",
+    )
+    parser.add_argument(
+        "--c-binary-name",
+        default="c_secp256k1_bench",
+        help="Filename for the compiled C benchmark binary.",
+    )
+    parser.add_argument(
+        "--c-label",
+        default="c (libsecp256k1)",
+        help="Label to display for the native C baseline.",
+    )
+    parser.add_argument(
+        "--coincurve-label",
+        default="libsecp256k1 (coincurve)",
+        help="Label to display for the coincurve baseline.",
+    )
+    parser.add_argument(
+        "--mojo-jit-label",
+        default="mojo (jit)",
+        help="Label to display for the Mojo JIT result.",
+    )
+    parser.add_argument(
+        "--mojo-compiled-label",
+        default="mojo (compiled)",
+        help="Label to display for the Mojo compiled result.",
+    )
+    args = parser.parse_args(argv)
+
+    root = Path(__file__).resolve().parents[1]
+    results: List[Result] = []
+
+    if not args.skip_coincurve:
+        results.extend(_collect_python_results(root, args))
+
+    if not args.skip_c:
+        results.extend(_collect_c_baseline(root, args))
+
+    if not args.skip_mojo_jit or not args.skip_mojo_compiled:
+        mojo = _ensure_mojo()
+        if not args.skip_mojo_jit:
+            results.extend(_collect_mojo_jit(root, mojo, args))
+        if not args.skip_mojo_compiled:
+            results.extend(_collect_mojo_compiled(root, mojo, args))
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+    else:
+        print(_format_table(results))
+        if not args.skip_c:
+            print()
+            print(_format_ratios(results, args.c_label))
+    problems = _check_checksums(results)
+    for problem in problems:
+        print(problem, file=sys.stderr)
+    return 1 if problems else 0
+
+
+if __name__ == "__main__":  # pragma: no cover - CLI entry point
+    sys.exit(main())
@@ -17,27 +17,41 @@
 #define LENGTH_STRIDE 31
 #define WARMUP_ROUNDS 3
 
+// Size sweep: equal-length messages per bucket, MULTI_LANES distinct inputs
+// (one batch for keccak256_x4), about BUCKET_BYTES hashed per bucket.
+#define MULTI_LANES 4
+#define BUCKET_BYTES (64u << 20)
+#define MAX_SIZES 32
+
+static const size_t default_sizes[] = {32, 64, 128, 256, 512, 1024, 4096, 16384, 65536, 262144, 1048576};
+
+static uint8_t messages[NUM_MESSAGES][MAX_LENGTH];
+static size_t lengths[NUM_MESSAGES];
+
 static size_t message_length(size_t index) {
     size_t span = (size_t)(MAX_LENGTH - BASE_LENGTH + 1);
     return (size_t)BASE_LENGTH + ((index * LENGTH_STRIDE) % span);
 }
 
-static void generate_message(size_t index, uint8_t *buffer, size_t *out_length) {
-    size_t length = message_length(index);
+static void generate_message(size_t index, uint8_t *buffer, size_t length) {
     for (size_t offset = 0; offset < length; ++offset) {
         buffer[offset] = (uint8_t)((index + offset) % 256);
     }
-    *out_length = length;
+}
+
+static void generate_messages(void) {
+    // built once, outside every timed region
+    for (size_t idx = 0; idx < NUM_MESSAGES; ++idx) {
+        lengths[idx] = message_length(idx);
+        generate_message(idx, messages[idx], lengths[idx]);
+    }
 }
 
 static void warm_up(void) {
-    uint8_t message[MAX_LENGTH];
-    size_t length = 0;
     uint8_t digest[KECCAK256_DIGEST_LENGTH];
     for (int round = 0; round < WARMUP_ROUNDS; ++round) {
         for (size_t idx = 0; idx < NUM_MESSAGES; ++idx) {
-            generate_message(idx, message, &length);
-            keccak256(message, length, digest);
+            keccak256(messages[idx], lengths[idx], digest);
         }
     }
 }
@@ -48,36 +62,111 @@ static double seconds_since(const struct timespec *start, const struct timespec
     return sec + nsec;
 }
 
+static void now(struct timespec *ts) {
+    if (clock_gettime(CLOCK_MONOTONIC, ts) != 0) {
+        perror("clock_gettime");
+        exit(EXIT_FAILURE);
+    }
+}
+
 static void run_benchmark(double *out_seconds, uint32_t *out_checksum) {
-    uint8_t message[MAX_LENGTH];
-    size_t length = 0;
     uint8_t digest[KECCAK256_DIGEST_LENGTH];
     uint32_t checksum = 0;
     struct timespec start;
     struct timespec end;
 
+    generate_messages();
     warm_up();
 
-    if (clock_gettime(CLOCK_MONOTONIC, &start) != 0) {
-        perror("clock_gettime");
-        exit(EXIT_FAILURE);
-    }
-
+    now(&start);
     for (int round = 0; round < ROUNDS; ++round) {
         for (size_t idx = 0; idx < NUM_MESSAGES; ++idx) {
-            generate_message(idx, message, &length);
-            keccak256(message, length, digest);
+            keccak256(messages[idx], lengths[idx], digest);
             checksum ^= digest[0];
         }
     }
+    now(&end);
 
-    if (clock_gettime(CLOCK_MONOTONIC, &end) != 0) {
-        perror("clock_gettime");
+    *out_seconds = seconds_since(&start, &end);
+    *out_checksum = checksum;
+}
+
+struct bucket_result {
+    size_t size;
+    size_t hashes;
+    double seconds;
+    uint32_t checksum;
+};
+
+static uint32_t fold_digests(uint8_t digests[][KECCAK256_DIGEST_LENGTH], int lanes) {
+    // FNV-1a over every byte of every digest, so one wrong byte anywhere shows
+    uint32_t h = 2166136261u;
+    for (int k = 0; k < lanes; ++k) {
+        for (int i = 0; i < KECCAK256_DIGEST_LENGTH; ++i) {
+            h = (h ^ digests[k][i]) * 16777619u;
+        }
+    }
+    return h;
+}
+
+static struct bucket_result run_bucket(size_t size, int multi) {
+    // MULTI_LANES distinct messages of one size; the checksum folds the full
+    // digests the last timed pass wrote, so it covers the measured work and
+    // matches between the scalar and multi-buffer modes
+    struct bucket_result res = {size, 0, 0.0, 0};
+    uint8_t digests[MULTI_LANES][KECCAK256_DIGEST_LENGTH];
+    const uint8_t *ins[MULTI_LANES];
+    uint8_t *outs[MULTI_LANES];
+    uint8_t *buffer = malloc(size * MULTI_LANES);
+    struct timespec start;
+    struct timespec end;
+
+    if (buffer == NULL) {
+        perror("malloc");
         exit(EXIT_FAILURE);
     }
+    for (int k = 0; k < MULTI_LANES; ++k) {
+        generate_message((size_t)k, buffer + (size_t)k * size, size);
+        ins[k] = buffer + (size_t)k * size;
+        outs[k] = digests[k];
+    }
+    size_t passes = BUCKET_BYTES / (size * MULTI_LANES);
+    if (passes == 0) {
+        passes = 1;
+    }
 
-    *out_seconds = seconds_since(&start, &end);
-    *out_checksum = checksum;
+    memset(digests, 0, sizeof(digests));
+
+    now(&start);
+    for (size_t pass = 0; pass < passes; ++pass) {
+        if (multi) {
+            keccak256_x4(ins, size, outs);
+        } else {
+            for (int k = 0; k < MULTI_LANES; ++k) {
+                keccak256(ins[k], size, outs[k]);
+            }
+        }
+    }
+    now(&end);
+
+    res.checksum = fold_digests(digests, MULTI_LANES);
+    free(buffer);
+    res.hashes = passes * MULTI_LANES;
+    res.seconds = seconds_since(&start, &end);
+    return res;
+}
+
+static size_t parse_sizes(const char *list, size_t *out) {
+    size_t n = 0;
+    char *copy = strdup(list);
+    for (char *tok = strtok(copy, ","); tok != NULL && n < MAX_SIZES; tok = strtok(NULL, ",")) {
+        long v = strtol(tok, NULL, 10);
+        if (v > 0) {
+            out[n++] = (size_t)v;
+        }
+    }
+    free(copy);
+    return n;
 }
 
 static void print_table(const char *label, double seconds, double hashes_per_second, uint32_t checksum) {
@@ -91,9 +180,50 @@ static void print_json(const char *label, double seconds, double hashes_per_seco
            label, seconds, hashes_per_second, checksum);
 }
 
+static void print_buckets(const char *label, const char *mode, const struct bucket_result *res, size_t n,
+                          double ghz, int emit_json) {
+    // cycles/byte is seconds * clock / bytes, so it needs the core clock in --ghz
+    if (emit_json) {
+        printf("[");
+    } else {
+        printf("implementation | mode | size | bytes/s | cycles/byte | checksum\n");
+        printf("-------------- | ---- | ---- | ------- | ----------- | --------\n");
+    }
+    for (size_t i = 0; i < n; ++i) {
+        double bytes = (double)res[i].size * (double)res[i].hashes;
+        double bps = res[i].seconds > 0.0 ? bytes / res[i].seconds : 0.0;
+        double cpb = ghz > 0.0 ? res[i].seconds * ghz * 1e9 / bytes : 0.0;
+        if (emit_json) {
+            printf("%s{\"implementation\": \"%s\", \"mode\": \"%s\", \"size\": %zu, \"hashes\": %zu, "
+                   "\"seconds\": %.12f, \"bytes_per_second\": %.2f, \"hashes_per_second\": %.2f, ",
+                   i > 0 ? ", " : "", label, mode, res[i].size, res[i].hashes, res[i].seconds, bps,
+                   res[i].seconds > 0.0 ? (double)res[i].hashes / res[i].seconds : 0.0);
+            if (ghz > 0.0) {
+                printf("\"cycles_per_byte\": %.3f, ", cpb);
+            } else {
+                printf("\"cycles_per_byte\": null, ");
+            }
+            printf("\"checksum\": %u}", res[i].checksum);
+        } else if (ghz > 0.0) {
+            printf("%s | %s | %zu | %.2f | %.3f | %u\n", label, mode, res[i].size, bps, cpb, res[i].checksum);
+        } else {
+            printf("%s | %s | %zu | %.2f | - | %u\n", label, mode, res[i].size, bps, res[i].checksum);
+        }
+    }
+    if (emit_json) {
+        printf("]\n");
+    }
+}
+
 int main(int argc, char **argv) {
-    const char *label = "c (tiny-sha3)";
+    const char *label = "c (unrolled)";
     int emit_json = 0;
+    int sweep = 0;
+    int multi = 0;
+    double ghz = 0.0;
+    size_t sizes[MAX_SIZES];
+    size_t num_sizes = sizeof(default_sizes) / sizeof(default_sizes[0]);
+    memcpy(sizes, default_sizes, sizeof(default_sizes));
 
     for (int i = 1; i < argc; ++i) {
         if (strcmp(argv[i], "--json") == 0) {
@@ -101,7 +231,27 @@ int main(int argc, char **argv) {
         } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
             label = argv[i + 1];
             ++i;
+        } else if (strcmp(argv[i], "--sweep") == 0) {
+            sweep = 1;
+        } else if (strcmp(argv[i], "--multi") == 0) {
+            sweep = 1;
+            multi = 1;
+        } else if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc) {
+            num_sizes = parse_sizes(argv[i + 1], sizes);
+            ++i;
+        } else if (strcmp(argv[i], "--ghz") == 0 && i + 1 < argc) {
+            ghz = strtod(argv[i + 1], NULL);
+            ++i;
+        }
+    }
+
+    if (sweep) {
+        struct bucket_result results[MAX_SIZES];
+        for (size_t i = 0; i < num_sizes; ++i) {
+            results[i] = run_bucket(sizes[i], multi);
         }
+        print_buckets(label, multi ? "multi" : "sweep", results, num_sizes, ghz, emit_json);
+        return 0;
     }
 
     double seconds = 0.0;
@@ -1,10 +1,24 @@
-// keccak256.c - Adapted tiny_sha3 Keccak-256 implementation.
+// keccak256.c - Keccak-256 native baseline.
 // SPDX-License-Identifier: MIT
 
 #include "keccak256.h"
 
-// This file is a trimmed version of tiny_sha3 with only the features
-// required for Keccak-256. See the original project for the full library.
+#include <string.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// The interface and padding follow tiny_sha3 by Markku-Juhani O. Saarinen
+// (https://github.com/mjosaarinen/tiny_sha3, MIT License). The permutation is
+// written out round by round in the style of the Keccak team's reference
+// "64-bit optimized" implementation: two rounds per step with the state
+// ping-ponging between two sets of named lanes, and the lane-complementing
+// transform so chi needs one NOT per row instead of five. Whole rate blocks
+// are absorbed as 64-bit words.
+
+#define KECCAK256_RATE 136
+#define KECCAK256_LANES (KECCAK256_RATE / 8)
 
 // Rotation macro.
 #define ROL64(x, y) (((x) << (y)) | ((x) >> (64 - (y))))
@@ -21,105 +35,264 @@ static const uint64_t keccakf_rndc[24] = {
     0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
 };
 
-// Rotation offsets.
-static const unsigned keccakf_rotc[24] = {
-     1,  3,  6, 10, 15, 21, 28, 36, 45, 55,  2, 14,
-    27, 41, 56,  8, 25, 43, 62, 18, 39, 61, 20, 44,
-};
+static inline uint64_t load64_le(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
 
-// Permutation index.
-static const unsigned keccakf_piln[24] = {
-    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
-    15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1,
-};
+static inline void store64_le(uint8_t *p, uint64_t v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    memcpy(p, &v, sizeof(v));
+}
+
+// Lanes are named A<row><column> with rows b, g, k, m, s (y = 0..4) and columns
+// a, e, i, o, u (x = 0..4); state index is x + 5 * y.
+#define DECLARE_LANES(P)                                              \
+    uint64_t P##ba, P##be, P##bi, P##bo, P##bu, P##ga, P##ge, P##gi,  \
+        P##go, P##gu, P##ka, P##ke, P##ki, P##ko, P##ku, P##ma, P##me,\
+        P##mi, P##mo, P##mu, P##sa, P##se, P##si, P##so, P##su
+
+// One round from lanes A into lanes E. Lanes be, bi, go, ki, mi and sa are kept
+// complemented, which is what lets each chi row use a single NOT.
+#define THETA_RHO_PI_CHI_IOTA(A, E, rc)                               \
+    do {                                                              \
+        uint64_t Ca = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa;          \
+        uint64_t Ce = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se;          \
+        uint64_t Ci = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si;          \
+        uint64_t Co = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so;          \
+        uint64_t Cu = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su;          \
+        uint64_t Da = Cu ^ ROL64(Ce, 1);                              \
+        uint64_t De = Ca ^ ROL64(Ci, 1);                              \
+        uint64_t Di = Ce ^ ROL64(Co, 1);                              \
+        uint64_t Do = Ci ^ ROL64(Cu, 1);                              \
+        uint64_t Du = Co ^ ROL64(Ca, 1);                              \
+        uint64_t Ba, Be, Bi, Bo, Bu;                                  \
+                                                                      \
+        Ba = A##ba ^ Da;                                              \
+        Be = ROL64(A##ge ^ De, 44);                                   \
+        Bi = ROL64(A##ki ^ Di, 43);                                   \
+        Bo = ROL64(A##mo ^ Do, 21);                                   \
+        Bu = ROL64(A##su ^ Du, 14);                                   \
+        E##ba = Ba ^ (Be | Bi) ^ (rc);                                \
+        E##be = Be ^ ((~Bi) | Bo);                                    \
+        E##bi = Bi ^ (Bo & Bu);                                       \
+        E##bo = Bo ^ (Bu | Ba);                                       \
+        E##bu = Bu ^ (Ba & Be);                                       \
+                                                                      \
+        Ba = ROL64(A##bo ^ Do, 28);                                   \
+        Be = ROL64(A##gu ^ Du, 20);                                   \
+        Bi = ROL64(A##ka ^ Da, 3);                                    \
+        Bo = ROL64(A##me ^ De, 45);                                   \
+        Bu = ROL64(A##si ^ Di, 61);                                   \
+        E##ga = Ba ^ (Be | Bi);                                       \
+        E##ge = Be ^ (Bi & Bo);                                       \
+        E##gi = Bi ^ (Bo | (~Bu));                                    \
+        E##go = Bo ^ (Bu | Ba);                                       \
+        E##gu = Bu ^ (Ba & Be);                                       \
+                                                                      \
+        Ba = ROL64(A##be ^ De, 1);                                    \
+        Be = ROL64(A##gi ^ Di, 6);                                    \
+        Bi = ROL64(A##ko ^ Do, 25);                                   \
+        Bo = ROL64(A##mu ^ Du, 8);                                    \
+        Bu = ROL64(A##sa ^ Da, 18);                                   \
+        E##ka = Ba ^ (Be | Bi);                                       \
+        E##ke = Be ^ (Bi & Bo);                                       \
+        E##ki = Bi ^ ((~Bo) & Bu);                                    \
+        E##ko = (~Bo) ^ (Bu | Ba);                                    \
+        E##ku = Bu ^ (Ba & Be);                                       \
+                                                                      \
+        Ba = ROL64(A##bu ^ Du, 27);                                   \
+        Be = ROL64(A##ga ^ Da, 36);                                   \
+        Bi = ROL64(A##ke ^ De, 10);                                   \
+        Bo = ROL64(A##mi ^ Di, 15);                                   \
+        Bu = ROL64(A##so ^ Do, 56);                                   \
+        E##ma = Ba ^ (Be & Bi);                                       \
+        E##me = Be ^ (Bi | Bo);                                       \
+        E##mi = Bi ^ ((~Bo) | Bu);                                    \
+        E##mo = (~Bo) ^ (Bu & Ba);                                    \
+        E##mu = Bu ^ (Ba | Be);                                       \
+                                                                      \
+        Ba = ROL64(A##bi ^ Di, 62);                                   \
+        Be = ROL64(A##go ^ Do, 55);                                   \
+        Bi = ROL64(A##ku ^ Du, 39);                                   \
+        Bo = ROL64(A##ma ^ Da, 41);                                   \
+        Bu = ROL64(A##se ^ De, 2);                                    \
+        E##sa = Ba ^ ((~Be) & Bi);                                    \
+        E##se = (~Be) ^ (Bi | Bo);                                    \
+        E##si = Bi ^ (Bo & Bu);                                       \
+        E##so = Bo ^ (Bu | Ba);                                       \
+        E##su = Bu ^ (Ba & Be);                                       \
+    } while (0)
+
+#define COPY_FROM_STATE(P, st)                                                      \
+    P##ba = (st)[0];  P##be = ~(st)[1];  P##bi = ~(st)[2];  P##bo = (st)[3];        \
+    P##bu = (st)[4];  P##ga = (st)[5];   P##ge = (st)[6];   P##gi = (st)[7];        \
+    P##go = ~(st)[8]; P##gu = (st)[9];   P##ka = (st)[10];  P##ke = (st)[11];       \
+    P##ki = ~(st)[12]; P##ko = (st)[13]; P##ku = (st)[14];  P##ma = (st)[15];       \
+    P##me = (st)[16]; P##mi = ~(st)[17]; P##mo = (st)[18];  P##mu = (st)[19];       \
+    P##sa = ~(st)[20]; P##se = (st)[21]; P##si = (st)[22];  P##so = (st)[23];       \
+    P##su = (st)[24]
+
+#define COPY_TO_STATE(st, P)                                                        \
+    (st)[0] = P##ba;  (st)[1] = ~P##be;  (st)[2] = ~P##bi;  (st)[3] = P##bo;        \
+    (st)[4] = P##bu;  (st)[5] = P##ga;   (st)[6] = P##ge;   (st)[7] = P##gi;        \
+    (st)[8] = ~P##go; (st)[9] = P##gu;   (st)[10] = P##ka;  (st)[11] = P##ke;       \
+    (st)[12] = ~P##ki; (st)[13] = P##ko; (st)[14] = P##ku;  (st)[15] = P##ma;       \
+    (st)[16] = P##me; (st)[17] = ~P##mi; (st)[18] = P##mo;  (st)[19] = P##mu;       \
+    (st)[20] = ~P##sa; (st)[21] = P##se; (st)[22] = P##si;  (st)[23] = P##so;       \
+    (st)[24] = P##su
+
+#define TWO_ROUNDS(r)                                                 \
+    THETA_RHO_PI_CHI_IOTA(A, E, keccakf_rndc[(r)]);                   \
+    THETA_RHO_PI_CHI_IOTA(E, A, keccakf_rndc[(r) + 1])
 
-// Internal state.
-typedef struct {
-    uint64_t state[25];
-    unsigned rate;
-    unsigned capacity;
-    unsigned absorbed;
-} sha3_ctx;
-
-static void sha3_init(sha3_ctx *ctx, unsigned rate_bits) {
-    ctx->rate = rate_bits / 8;
-    ctx->capacity = (1600 / 8) - ctx->rate;
-    ctx->absorbed = 0;
-    for (unsigned i = 0; i < 25; ++i) {
-        ctx->state[i] = 0;
+static void keccakf(uint64_t st[25]) {
+    DECLARE_LANES(A);
+    DECLARE_LANES(E);
+    COPY_FROM_STATE(A, st);
+    TWO_ROUNDS(0);
+    TWO_ROUNDS(2);
+    TWO_ROUNDS(4);
+    TWO_ROUNDS(6);
+    TWO_ROUNDS(8);
+    TWO_ROUNDS(10);
+    TWO_ROUNDS(12);
+    TWO_ROUNDS(14);
+    TWO_ROUNDS(16);
+    TWO_ROUNDS(18);
+    TWO_ROUNDS(20);
+    TWO_ROUNDS(22);
+    COPY_TO_STATE(st, A);
+}
+
+static void absorb_block(uint64_t st[25], const uint8_t *block) {
+    for (unsigned i = 0; i < KECCAK256_LANES; ++i) {
+        st[i] ^= load64_le(block + 8 * i);
     }
+    keccakf(st);
 }
 
-static void keccakf(uint64_t st[25]) {
-    for (int round = 0; round < 24; ++round) {
-        uint64_t bc[5];
+static void pad_tail(uint8_t block[KECCAK256_RATE], const uint8_t *tail, size_t length) {
+    memset(block, 0, KECCAK256_RATE);
+    if (length > 0) {
+        memcpy(block, tail, length);
+    }
+    block[length] ^= 0x01;
+    block[KECCAK256_RATE - 1] ^= 0x80;
+}
+
+void keccak256(const uint8_t *message, size_t length, uint8_t digest[KECCAK256_DIGEST_LENGTH]) {
+    uint64_t st[25] = {0};
+    uint8_t block[KECCAK256_RATE];
+
+    while (length >= KECCAK256_RATE) {
+        absorb_block(st, message);
+        message += KECCAK256_RATE;
+        length -= KECCAK256_RATE;
+    }
+    pad_tail(block, message, length);
+    absorb_block(st, block);
 
-        // Theta
-        for (int i = 0; i < 5; ++i) {
-            bc[i] = st[i] ^ st[i + 5] ^ st[i + 10] ^ st[i + 15] ^ st[i + 20];
+    for (unsigned i = 0; i < KECCAK256_DIGEST_LENGTH / 8; ++i) {
+        store64_le(digest + 8 * i, st[i]);
+    }
+}
+
+#ifdef __AVX2__
+
+// Four independent states, one per 64-bit lane of each __m256i. Plain chi
+// here: AVX2 has andnot, so complementing lanes would not save anything.
+#define V_ROL64(x, y) _mm256_or_si256(_mm256_slli_epi64((x), (y)), _mm256_srli_epi64((x), 64 - (y)))
+#define V_XOR(a, b) _mm256_xor_si256((a), (b))
+#define V_CHI(a, b, c) _mm256_xor_si256((a), _mm256_andnot_si256((b), (c)))
+
+static const uint8_t keccakf_rho[25] = {
+     0,  1, 62, 28, 27, 36, 44,  6, 55, 20,  3, 10, 43,
+    25, 39, 41, 45, 15, 21,  8, 18,  2, 61, 56, 14,
+};
+
+static void keccakf_x4(__m256i st[25]) {
+    for (int round = 0; round < 24; ++round) {
+        __m256i c[5];
+        __m256i b[25];
+        for (int x = 0; x < 5; ++x) {
+            c[x] = V_XOR(V_XOR(V_XOR(st[x], st[x + 5]), V_XOR(st[x + 10], st[x + 15])), st[x + 20]);
         }
-        for (int i = 0; i < 5; ++i) {
-            uint64_t t = bc[(i + 4) % 5] ^ ROL64(bc[(i + 1) % 5], 1);
-            for (int j = 0; j < 25; j += 5) {
-                st[j + i] ^= t;
+        for (int x = 0; x < 5; ++x) {
+            __m256i d = V_XOR(c[(x + 4) % 5], V_ROL64(c[(x + 1) % 5], 1));
+            for (int y = 0; y < 25; y += 5) {
+                st[y + x] = V_XOR(st[y + x], d);
             }
         }
-
-        // Rho and Pi
-        uint64_t t = st[1];
-        for (int i = 0; i < 24; ++i) {
-            int j = keccakf_piln[i];
-            uint64_t tmp = st[j];
-            st[j] = ROL64(t, keccakf_rotc[i]);
-            t = tmp;
-        }
-
-        // Chi
-        for (int j = 0; j < 25; j += 5) {
-            uint64_t temp[5];
-            for (int i = 0; i < 5; ++i) {
-                temp[i] = st[j + i];
+        // rho and pi: lane (x, y) moves to (y, 2x + 3y)
+        for (int y = 0; y < 5; ++y) {
+            for (int x = 0; x < 5; ++x) {
+                int i = x + 5 * y;
+                int j = y + 5 * ((2 * x + 3 * y) % 5);
+                b[j] = keccakf_rho[i] == 0 ? st[i] : V_ROL64(st[i], keccakf_rho[i]);
             }
-            for (int i = 0; i < 5; ++i) {
-                st[j + i] ^= (~temp[(i + 1) % 5]) & temp[(i + 2) % 5];
+        }
+        for (int y = 0; y < 25; y += 5) {
+            for (int x = 0; x < 5; ++x) {
+                st[y + x] = V_CHI(b[y + x], b[y + (x + 1) % 5], b[y + (x + 2) % 5]);
             }
         }
+        st[0] = V_XOR(st[0], _mm256_set1_epi64x((long long)keccakf_rndc[round]));
+    }
+}
 
-        // Iota
-        st[0] ^= keccakf_rndc[round];
+static void absorb_block_x4(__m256i st[25], const uint8_t *const blocks[4]) {
+    for (unsigned i = 0; i < KECCAK256_LANES; ++i) {
+        __m256i v = _mm256_set_epi64x((long long)load64_le(blocks[3] + 8 * i), (long long)load64_le(blocks[2] + 8 * i),
+                                      (long long)load64_le(blocks[1] + 8 * i), (long long)load64_le(blocks[0] + 8 * i));
+        st[i] = V_XOR(st[i], v);
     }
+    keccakf_x4(st);
 }
 
-static void sha3_update(sha3_ctx *ctx, const uint8_t *message, size_t length) {
-    unsigned rate = ctx->rate;
-    unsigned idx = ctx->absorbed;
+void keccak256_x4(const uint8_t *const messages[4], size_t length, uint8_t *const digests[4]) {
+    __m256i st[25];
+    uint8_t tails[4][KECCAK256_RATE];
+    const uint8_t *blocks[4];
+    size_t offset = 0;
 
-    while (length--) {
-        ((uint8_t *)ctx->state)[idx++] ^= *message++;
-        if (idx == rate) {
-            keccakf(ctx->state);
-            idx = 0;
+    for (int i = 0; i < 25; ++i) {
+        st[i] = _mm256_setzero_si256();
+    }
+    while (length - offset >= KECCAK256_RATE) {
+        for (int k = 0; k < 4; ++k) {
+            blocks[k] = messages[k] + offset;
         }
+        absorb_block_x4(st, blocks);
+        offset += KECCAK256_RATE;
     }
-    ctx->absorbed = idx;
-}
+    for (int k = 0; k < 4; ++k) {
+        pad_tail(tails[k], messages[k] + offset, length - offset);
+        blocks[k] = tails[k];
+    }
+    absorb_block_x4(st, blocks);
 
-static void sha3_finalize(sha3_ctx *ctx, uint8_t *digest) {
-    unsigned rate = ctx->rate;
-    uint8_t *state_bytes = (uint8_t *)ctx->state;
+    for (unsigned i = 0; i < KECCAK256_DIGEST_LENGTH / 8; ++i) {
+        uint64_t lanes[4];
+        _mm256_storeu_si256((__m256i *)lanes, st[i]);
+        for (int k = 0; k < 4; ++k) {
+            store64_le(digests[k] + 8 * i, lanes[k]);
+        }
+    }
+}
 
-    state_bytes[ctx->absorbed] ^= 0x01;
-    state_bytes[rate - 1] ^= 0x80;
-    keccakf(ctx->state);
+#else
 
-    for (unsigned i = 0; i < KECCAK256_DIGEST_LENGTH; ++i) {
-        digest[i] = state_bytes[i];
+void keccak256_x4(const uint8_t *const messages[4], size_t length, uint8_t *const digests[4]) {
+    for (int k = 0; k < 4; ++k) {
+        keccak256(messages[k], length, digests[k]);
     }
 }
 
-void keccak256(const uint8_t *message, size_t length, uint8_t digest[KECCAK256_DIGEST_LENGTH]) {
-    sha3_ctx ctx;
-    sha3_init(&ctx, 1088); // 1600 - 512 -> 1088-bit rate
-    sha3_update(&ctx, message, length);
-    sha3_finalize(&ctx, digest);
-}
+#endif
@@ -1,4 +1,4 @@
-// keccak256.h - Minimal SHA3/Keccak-256 interface for benchmark tests.
+// keccak256.h - Minimal Keccak-256 interface for benchmark tests.
 //
 // Adapted from tiny_sha3 by Markku-Juhani O. Saarinen.
 // Original project: https://github.com/mjosaarinen/tiny_sha3 (MIT License)
@@ -22,6 +22,10 @@ extern "C" {
 
 void keccak256(const uint8_t *message, size_t length, uint8_t digest[KECCAK256_DIGEST_LENGTH]);
 
+// Four equal-length messages at once (AVX2 when compiled with -mavx2, otherwise
+// four scalar calls); digests[k] receives the hash of messages[k].
+void keccak256_x4(const uint8_t *const messages[4], size_t length, uint8_t *const digests[4]);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,12 +30,42 @@ static int assert_digest(const char *label, const uint8_t *message, size_t lengt
     return 0;
 }
 
+static int assert_x4_matches(size_t length) {
+    // keccak256_x4 on four distinct messages agrees with four scalar calls
+    uint8_t messages[4][300];
+    uint8_t digests[4][KECCAK256_DIGEST_LENGTH];
+    uint8_t expected[KECCAK256_DIGEST_LENGTH];
+    const uint8_t *ins[4];
+    uint8_t *outs[4];
+    for (int k = 0; k < 4; ++k) {
+        for (size_t i = 0; i < length; ++i) {
+            messages[k][i] = (uint8_t)(k * 31 + i * 7);
+        }
+        ins[k] = messages[k];
+        outs[k] = digests[k];
+    }
+    keccak256_x4(ins, length, outs);
+    for (int k = 0; k < 4; ++k) {
+        keccak256(messages[k], length, expected);
+        if (memcmp(expected, digests[k], KECCAK256_DIGEST_LENGTH) != 0) {
+            fprintf(stderr, "keccak256_x4 mismatch: length %zu, lane %d\n", length, k);
+            return 1;
+        }
+    }
+    return 0;
+}
+
 int main(void) {
     int status = 0;
     status |= assert_digest("keccak256(\"abc\")", (const uint8_t *)"abc", 3,
                             "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
     status |= assert_digest("keccak256(\"\")", (const uint8_t *)"", 0,
                             "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+    // 64 and 135/136/137 cover the pubkey size and the rate-block boundary
+    static const size_t x4_lengths[] = {0, 64, 135, 136, 137, 272, 300};
+    for (size_t i = 0; i < sizeof(x4_lengths) / sizeof(x4_lengths[0]); ++i) {
+        status |= assert_x4_matches(x4_lengths[i]);
+    }
 
     if (status == 0) {
         printf("All C baseline tests passed.\n");
@@ -71,6 +71,63 @@ def _ensure_mojo() -> str:
     )
 
 
+def _mode_flags(args: argparse.Namespace) -> List[str]:
+    # size-sweep / multi-buffer flags understood by the C and Mojo drivers
+    flags: List[str] = []
+    if args.multi:
+        flags.append("--multi")
+    elif args.sweep:
+        flags.append("--sweep")
+    if args.sizes:
+        flags.extend(["--sizes", args.sizes])
+    if args.ghz:
+        flags.extend(["--ghz", str(args.ghz)])
+    return flags
+
+
+def _as_list(data: Result | List[Result]) -> List[Result]:
+    if isinstance(data, dict):
+        return [data]
+    return list(data)
+
+
+def _format_sweep_table(results: List[Result]) -> str:
+    headers = ("implementation", "mode", "size", "bytes/s", "cycles/byte", "checksum")
+    lines = [" | ".join(headers)]
+    lines.append(" | ".join("-" * len(h) for h in headers))
+    for result in sorted(results, key=lambda r: (int(r["size"]), str(r["implementation"]))):
+        cpb = result.get("cycles_per_byte")
+        lines.append(
+            " | ".join(
+                [
+                    str(result["implementation"]),
+                    str(result["mode"]),
+                    str(result["size"]),
+                    f"{float(result['bytes_per_second']):.2f}",
+                    "-" if cpb is None else f"{float(cpb):.3f}",
+                    str(result["checksum"]),
+                ]
+            )
+        )
+    return "\n".join(lines)
+
+
+def _check_sweep_checksums(results: List[Result]) -> List[str]:
+    # every driver hashes the same per-size inputs, so equal sizes must agree
+    seen: Dict[int, Result] = {}
+    problems: List[str] = []
+    for result in results:
+        size = int(result["size"])
+        if size not in seen:
+            seen[size] = result
+        elif result["checksum"] != seen[size]["checksum"]:
+            problems.append(
+                f"checksum mismatch at size {size}: {seen[size]['implementation']}={seen[size]['checksum']} "
+                f"vs {result['implementation']}={result['checksum']}"
+            )
+    return problems
+
+
 def _collect_python_results(root: Path, args: argparse.Namespace) -> List[Result]:
     cmd = [
         sys.executable,
@@ -88,7 +145,7 @@ def _collect_python_results(root: Path, args: argparse.Namespace) -> List[Result
     return list(data)
 
 
-def _collect_mojo_jit(root: Path, mojo: str, args: argparse.Namespace) -> Result:
+def _collect_mojo_jit(root: Path, mojo: str, args: argparse.Namespace) -> Result | List[Result]:
     cmd = [
         mojo,
         "-I",
@@ -97,17 +154,18 @@ def _collect_mojo_jit(root: Path, mojo: str, args: argparse.Namespace) -> Result
         "--label",
         args.mojo_jit_label,
         "--json",
+        *_mode_flags(args),
     ]
     output = _run_checked(cmd, cwd=root)
     data = _load_json(output)
-    if isinstance(data, list):
+    if isinstance(data, list) and not (args.sweep or args.multi):
         raise SystemExit("Unexpected list output from Mojo JIT benchmark.")
     return data
 
 
 def _collect_mojo_compiled(
     root: Path, mojo: str, args: argparse.Namespace
-) -> Result:
+) -> Result | List[Result]:
     build_dir = root / args.build_dir
     build_dir.mkdir(parents=True, exist_ok=True)
     binary = build_dir / args.binary_name
@@ -126,15 +184,16 @@ def _collect_mojo_compiled(
         "--label",
         args.mojo_compiled_label,
         "--json",
+        *_mode_flags(args),
     ]
     output = _run_checked(run_cmd, cwd=root)
     data = _load_json(output)
-    if isinstance(data, list):
+    if isinstance(data, list) and not (args.sweep or args.multi):
         raise SystemExit("Unexpected list output from Mojo compiled benchmark.")
     return data
 
 
-def _collect_c_baseline(root: Path, args: argparse.Namespace) -> Result:
+def _collect_c_baseline(root: Path, args: argparse.Namespace) -> Result | List[Result]:
     compiler = _ensure_tool(
         "cc",
         "Unable to locate a C compiler (`cc`). Install one (e.g. clang or gcc) before running the C baseline.",
@@ -153,6 +212,7 @@ def _collect_c_baseline(root: Path, args: argparse.Namespace) -> Result:
         "-Wall",
         "-Wextra",
         "-Werror",
+        *(["-mavx2"] if args.c_avx2 else []),
         *(str(src) for src in sources),
         "-o",
         str(binary),
@@ -163,10 +223,11 @@ def _collect_c_baseline(root: Path, args: argparse.Namespace) -> Result:
         "--label",
         args.c_label,
         "--json",
+        *_mode_flags(args),
     ]
     output = _run_checked(run_cmd, cwd=root)
     data = _load_json(output)
-    if isinstance(data, list):
+    if isinstance(data, list) and not (args.sweep or args.multi):
         raise SystemExit("Unexpected list output from C baseline benchmark.")
     return data
 
@@ -222,11 +283,37 @@ def main(argv: List[str] | None = None) -> int:
         action="store_true",
         help="Skip the C baseline benchmark.",
     )
+    parser.add_argument(
+        "--c-avx2",
+        action="store_true",
+        help="Build the C baseline with -mavx2 (enables the 4-way keccak256_x4 path).",
+    )
     parser.add_argument(
         "--skip-rust",
         action="store_true",
         help="Skip the Rust baseline benchmark.",
     )
+    parser.add_argument(
+        "--sweep",
+        action="store_true",
+        help="Run the per-size sweep (C and Mojo only) instead of the mixed-length schedule.",
+    )
+    parser.add_argument(
+        "--multi",
+        action="store_true",
+        help="Like --sweep, but hash through the multi-buffer APIs (keccak256_x4 / keccak256_xN).",
+    )
+    parser.add_argument(
+        "--sizes",
+        default="",
+        help="Comma-separated message sizes in bytes for --sweep/--multi (default: 32 B to 1 MiB).",
+    )
+    parser.add_argument(
+        "--ghz",
+        type=float,
+        default=0.0,
+        help="Core clock in GHz, used to report cycles/byte for --sweep/--multi.",
+    )
     parser.add_argument(
         "--json",
         action="store_true",
@@ -259,7 +346,7 @@ def main(argv: List[str] | None = None) -> int:
     )
     parser.add_argument(
         "--c-label",
-        default="c (tiny-sha3)",
+        default="c (unrolled)",
         help="Label to display for the C baseline.",
     )
     parser.add_argument(
@@ -272,6 +359,25 @@ def main(argv: List[str] | None = None) -> int:
     root = Path(__file__).resolve().parents[1]
     results: List[Result] = []
 
+    if args.sweep or args.multi:
+        # the Python and Rust baselines only run the mixed-length schedule
+        if not args.skip_c:
+            results.extend(_as_list(_collect_c_baseline(root, args)))
+        if not args.skip_mojo_jit or not args.skip_mojo_compiled:
+            mojo = _ensure_mojo()
+            if not args.skip_mojo_jit:
+                results.extend(_as_list(_collect_mojo_jit(root, mojo, args)))
+            if not args.skip_mojo_compiled:
+                results.extend(_as_list(_collect_mojo_compiled(root, mojo, args)))
+        if args.json:
+            print(json.dumps(results, indent=2))
+        else:
+            print(_format_sweep_table(results))
+        problems = _check_sweep_checksums(results)
+        for problem in problems:
+            print(problem, file=sys.stderr)
+        return 1 if problems else 0
+
     if not (args.skip_eth_hash and args.skip_pycryptodome):
         results.extend(_collect_python_results(root, args))
 
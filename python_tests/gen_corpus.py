@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Write a binary recovery corpus (secp256k1/corpus.mojo layout) signed by eth-keys.
+
+Header: b"SECPCRP1" + u64 LE record count; records: msg32 | r32 | s32 | v.
+Every record is a genuine low-s signature from an independent implementation.
+The signer's public key goes to the OUT.bin.keys sidecar (b"SECPKEY1" + the
+same count, then one 64-byte x || y per record), so `fuzz_all.mojo --corpus
+PATH` checks that recovery returns the key eth-keys signed with, and the
+benchmark's --corpus row times realistic inputs.
+
+    python python_tests/gen_corpus.py OUT.bin [COUNT] [SEED]
+"""
+import hashlib
+import struct
+import sys
+
+from eth_keys import keys
+
+MAGIC = b"SECPCRP1"
+KEYS_MAGIC = b"SECPKEY1"
+N = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+
+
+def _draw(seed: int, index: int, tag: bytes) -> bytes:
+    return hashlib.sha256(tag + struct.pack(">QQ", seed, index)).digest()
+
+
+def record(seed: int, index: int) -> tuple[bytes, bytes]:
+    """(97-byte record, 64-byte x || y of the signing key)."""
+    key = int.from_bytes(_draw(seed, index, b"key"), "big") % (N - 1) + 1
+    msg = _draw(seed, index, b"msg")
+    priv = keys.PrivateKey(key.to_bytes(32, "big"))
+    sig = priv.sign_msg_hash(msg)
+    r, s, v = sig.r, sig.s, sig.v
+    if s > N // 2:  # recovery enforces low-s; the twin recovers the same key
+        s, v = N - s, v ^ 1
+    rec = msg + r.to_bytes(32, "big") + s.to_bytes(32, "big") + bytes([27 + v])
+    return rec, priv.public_key.to_bytes()
+
+
+def main() -> int:
+    if len(sys.argv) < 2:
+        print(__doc__, file=sys.stderr)
+        return 2
+    path = sys.argv[1]
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 10000
+    seed = int(sys.argv[3]) if len(sys.argv) > 3 else 1
+    with open(path, "wb") as f, open(path + ".keys", "wb") as kf:
+        f.write(MAGIC + struct.pack("<Q", count))
+        kf.write(KEYS_MAGIC + struct.pack("<Q", count))
+        for i in range(count):
+            rec, pub = record(seed, i)
+            f.write(rec)
+            kf.write(pub)
+    print(f"wrote {count} records to {path} and their keys to {path}.keys")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
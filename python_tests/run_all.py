@@ -11,6 +11,19 @@ MOJO_TESTS = [
     "tests/test_ecdsa_recover.mojo",
     "tests/test_field_ops.mojo",
     "tests/test_edge_cases.mojo",
+    "tests/test_field_limb.mojo",
+    "tests/test_point_limb.mojo",
+    "tests/test_glv.mojo",
+    "tests/test_fixed_base.mojo",
+    "tests/test_constants.mojo",
+    "tests/test_ingest.mojo",
+    "tests/test_corpus.mojo",
+    "tests/test_stats.mojo",
+]
+
+# Rerun with the -D SECP256K1_STATS operation counters compiled in
+MOJO_STATS_TESTS = [
+    "tests/test_stats.mojo",
 ]
 
 # Cross-verification with Python/eth-keys
@@ -32,6 +45,7 @@ EXTRA_TESTS = [
 CMDS = (
     # Run core Mojo tests
     [f"mojo {MOJO_I} {test}" for test in MOJO_TESTS] +
+    [f"mojo -D SECP256K1_STATS {MOJO_I} {test}" for test in MOJO_STATS_TESTS] +
     # Run cross-verification tests
     [f'mojo {MOJO_I} {mojo} | .pixi/envs/default/bin/python {py}' 
      for mojo, py in VERIFY_TESTS] +